@@ -1,11 +1,19 @@
 #ifndef STOMFOOLERY_STOMFOOLERY_HPP
 #define STOMFOOLERY_STOMFOOLERY_HPP
 
+#include <bitset>
+#include <cstdint>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <ranges>
 #include <regex>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 namespace stomfoolery {
@@ -118,6 +126,66 @@ concept nested_return_type_iterator = std::forward_iterator<C> && requires(C c)
 	{ *c } -> contains_return_type_iterator<T>;
 };
 
+// Constants
+
+/**
+ * @brief Value for `max_splits` parameters that doesn't limit the number of splits.
+ */
+inline constexpr std::size_t no_split_limit = std::numeric_limits<std::size_t>::max();
+
+// Split policies
+
+/**
+ * @brief Tags to choose how `split` allocates its result.
+ */
+namespace split_policy {
+
+/**
+ * @brief Grow the container while splitting and shrink it to fit afterwards. This is what `split` does by default.
+ */
+struct grow_t {};
+/**
+ * @brief Count the substrings first and allocate the container exactly once. This searches the string twice.
+ */
+struct exact_t {};
+/**
+ * @brief Use `exact_t` for strings up to `exact_size_limit` bytes and `grow_t` for longer ones.
+ */
+struct automatic_t {};
+
+inline constexpr grow_t grow{};
+inline constexpr exact_t exact{};
+inline constexpr automatic_t automatic{};
+
+/**
+ * @brief Size in bytes up to which `automatic` searches the string twice. Strings this small usually are still in the
+ * cache for the second pass, which makes it cheaper than the reallocations.
+ */
+inline constexpr std::size_t exact_size_limit = 32 * 1024;
+
+}  // namespace split_policy
+
+/**
+ * @brief Result of measuring what `split` would return.
+ */
+struct split_measure {
+	/// Number of substrings
+	std::size_t count;
+	/// Sum of the lengths of all substrings. Not used by `split` itself, but lets callers allocate a single buffer
+	/// for all substrings
+	std::size_t total_size;
+
+	bool operator==(const split_measure&) const = default;
+};
+
+/**
+ * @brief The split_policy_tag concept checks if a type is one of the tags in `split_policy`.
+ * @tparam P Policy type
+ */
+template <typename P>
+concept split_policy_tag = std::same_as<P, split_policy::grow_t> || std::same_as<P, split_policy::exact_t> ||
+                           std::same_as<P, split_policy::automatic_t>;
+
 // #### repeat ####
 // Actual function
 
@@ -224,11 +292,33 @@ inline std::basic_string<string_like_char_t<S>> join(const C& container, const S
  * @param str_end Iterator pointing to the end of the string
  * @param separator_begin Iterator pointing to the start of the separator
  * @param separator_end Iterator pointing to the end of the separator
+ * @param max_splits Maximum number of splits to do. The last substring contains the unsplit rest of the string
  * @return A container of substrings
  */
 template <typename T, typename C = std::vector<std::basic_string<T>>, return_type_iterator<T> I1,
           return_type_iterator<T> I2>
-C split(I1 str_begin, I1 str_end, I2 separator_begin, I2 separator_end);
+C split(I1 str_begin, I1 str_end, I2 separator_begin, I2 separator_end, std::size_t max_splits = no_split_limit);
+
+/**
+ * @brief Splits an iterator based string into multiple substrings based on a specified iterator based string separator,
+ * allocating the container as chosen by the policy.
+ * @tparam T Char type of the string
+ * @tparam C Container type to store the resulting substrings
+ * @tparam I1 Iterator type representing the string
+ * @tparam I2 Iterator type representing the separator
+ * @tparam P Policy type
+ * @param str_begin Iterator pointing to the start of the string
+ * @param str_end Iterator pointing to the end of the string
+ * @param separator_begin Iterator pointing to the start of the separator
+ * @param separator_end Iterator pointing to the end of the separator
+ * @param policy One of the tags in `split_policy`
+ * @param max_splits Maximum number of splits to do. The last substring contains the unsplit rest of the string
+ * @return A container of substrings
+ */
+template <typename T, typename C = std::vector<std::basic_string<T>>, return_type_iterator<T> I1,
+          return_type_iterator<T> I2, split_policy_tag P>
+C split(I1 str_begin, I1 str_end, I2 separator_begin, I2 separator_end, P policy,
+        std::size_t max_splits = no_split_limit);
 
 // Helpers
 
@@ -239,13 +329,36 @@ C split(I1 str_begin, I1 str_end, I2 separator_begin, I2 separator_end);
  * @tparam C Container type to store the resulting substrings
  * @param str The string to split
  * @param separator The separator to split the string by
+ * @param max_splits Maximum number of splits to do. The last substring contains the unsplit rest of the string
  * @return A container of substrings
  */
 template <string_like S1, string_like S2, typename C = std::vector<std::basic_string<string_like_char_t<S1>>>>
     requires same_char_type<S1, S2>
-inline C split(const S1& str, const S2& separator) {
+inline C split(const S1& str, const S2& separator, std::size_t max_splits = no_split_limit) {
 	return split<string_like_char_t<S1>, C>(std::ranges::begin(str), std::ranges::end(str),
-	                                        std::ranges::begin(separator), std::ranges::end(separator));
+	                                        std::ranges::begin(separator), std::ranges::end(separator), max_splits);
+}
+
+/**
+ * @brief Splits a string into multiple substrings based on a specified string separator, allocating the container as
+ * chosen by the policy.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @tparam P Policy type
+ * @tparam C Container type to store the resulting substrings
+ * @param str The string to split
+ * @param separator The separator to split the string by
+ * @param policy One of the tags in `split_policy`
+ * @param max_splits Maximum number of splits to do. The last substring contains the unsplit rest of the string
+ * @return A container of substrings
+ */
+template <string_like S1, string_like S2, split_policy_tag P,
+          typename C = std::vector<std::basic_string<string_like_char_t<S1>>>>
+    requires same_char_type<S1, S2>
+inline C split(const S1& str, const S2& separator, P policy, std::size_t max_splits = no_split_limit) {
+	return split<string_like_char_t<S1>, C>(std::ranges::begin(str), std::ranges::end(str),
+	                                        std::ranges::begin(separator), std::ranges::end(separator), policy,
+	                                        max_splits);
 }
 
 // #### split by regex ####
@@ -259,10 +372,30 @@ inline C split(const S1& str, const S2& separator) {
  * @param begin Iterator pointing to the start of the string
  * @param end Iterator pointing to the end of the string
  * @param separator Regex based seperator
+ * @param max_splits Maximum number of splits to do. The last substring contains the unsplit rest of the string
  * @return A container of substrings
  */
 template <typename T, typename C = std::vector<std::basic_string<T>>, return_type_iterator<T> I>
-C split(I begin, I end, const std::basic_regex<T>& separator);
+C split(I begin, I end, const std::basic_regex<T>& separator, std::size_t max_splits = no_split_limit);
+
+/**
+ * @brief Splits an iterator based string into multiple substrings based on a specified regex separator, allocating the
+ * container as chosen by the policy.
+ * @tparam T Char type of the string
+ * @tparam C Container type to store the resulting substrings
+ * @tparam I Iterator type representing the string
+ * @tparam P Policy type
+ * @param begin Iterator pointing to the start of the string
+ * @param end Iterator pointing to the end of the string
+ * @param separator Regex based seperator
+ * @param policy One of the tags in `split_policy`
+ * @param max_splits Maximum number of splits to do. The last substring contains the unsplit rest of the string
+ * @return A container of substrings
+ *
+ * Running a regex twice is never cheaper than reallocating, so only `split_policy::exact` counts the substrings first.
+ */
+template <typename T, typename C = std::vector<std::basic_string<T>>, return_type_iterator<T> I, split_policy_tag P>
+C split(I begin, I end, const std::basic_regex<T>& separator, P policy, std::size_t max_splits = no_split_limit);
 
 // Helpers
 
@@ -272,11 +405,855 @@ C split(I begin, I end, const std::basic_regex<T>& separator);
  * @tparam C Container type to store the resulting substrings
  * @param str The string to split
  * @param separator The separator to split the string by
+ * @param max_splits Maximum number of splits to do. The last substring contains the unsplit rest of the string
  * @return A container of substrings
  */
 template <string_like S, typename C = std::vector<std::basic_string<string_like_char_t<S>>>>
-inline C split(const S& str, const std::basic_regex<string_like_char_t<S>>& separator) {
-	return split<string_like_char_t<S>, C>(std::ranges::begin(str), std::ranges::end(str), separator);
+inline C split(const S& str, const std::basic_regex<string_like_char_t<S>>& separator,
+               std::size_t max_splits = no_split_limit) {
+	return split<string_like_char_t<S>, C>(std::ranges::begin(str), std::ranges::end(str), separator, max_splits);
+}
+
+/**
+ * @brief Splits a string into multiple substrings based on a specified regex separator, allocating the container as
+ * chosen by the policy.
+ * @tparam S String like type
+ * @tparam P Policy type
+ * @tparam C Container type to store the resulting substrings
+ * @param str The string to split
+ * @param separator The separator to split the string by
+ * @param policy One of the tags in `split_policy`
+ * @param max_splits Maximum number of splits to do. The last substring contains the unsplit rest of the string
+ * @return A container of substrings
+ */
+template <string_like S, split_policy_tag P, typename C = std::vector<std::basic_string<string_like_char_t<S>>>>
+inline C split(const S& str, const std::basic_regex<string_like_char_t<S>>& separator, P policy,
+               std::size_t max_splits = no_split_limit) {
+	return split<string_like_char_t<S>, C>(std::ranges::begin(str), std::ranges::end(str), separator, policy,
+	                                       max_splits);
+}
+
+// #### flat table ####
+
+/**
+ * @brief Flattened result of splitting many things at once, like a container of containers without one allocation per
+ * row.
+ * @tparam E Element type
+ *
+ * All elements of all rows are stored in a single container. The elements of row `i` are the ones in the range
+ * `[offsets[i], offsets[i + 1])`, which is also what `operator[]` returns.
+ */
+template <typename E>
+struct flat_table {
+	/// All elements of all rows, in order
+	std::vector<E> elements;
+	/// Index of the first element of each row, followed by the total element count
+	std::vector<std::size_t> offsets;
+
+	/**
+	 * @brief Number of rows.
+	 * @return The number of rows
+	 */
+	std::size_t size() const noexcept {
+		return offsets.empty() ? 0 : offsets.size() - 1;
+	}
+
+	/**
+	 * @brief Access the elements of a single row.
+	 * @param index Index of the row
+	 * @return A span of the elements of that row
+	 */
+	std::span<const E> operator[](std::size_t index) const {
+		return std::span<const E>{elements}.subspan(offsets[index], offsets[index + 1] - offsets[index]);
+	}
+};
+
+// #### split batch ####
+// Result type
+
+/**
+ * @brief Flattened result of splitting many strings at once. Row `i` holds the tokens of input `i`.
+ * @tparam T Char type of the strings
+ *
+ * The tokens are views into the original inputs, so these need to outlive the result.
+ */
+template <typename T>
+using split_batch_result = flat_table<std::basic_string_view<T>>;
+
+// Actual function
+
+/**
+ * @brief Splits a range of iterator based strings based on a specified iterator based string separator in one go.
+ * @tparam T Char type of the strings
+ * @tparam CI Iterator type for the container of strings
+ * @tparam I Iterator type representing the separator
+ * @param inputs_begin Iterator pointing to the start of the container
+ * @param inputs_end Iterator pointing to the end of the container
+ * @param separator_begin Iterator pointing to the start of the separator
+ * @param separator_end Iterator pointing to the end of the separator
+ * @return The flattened tokens of all inputs
+ *
+ * Each input is split exactly like `split` would, but all tokens end up in one container of views. This saves the
+ * container construction and the copy of every token, which dominates when splitting lots of short strings.
+ */
+template <typename T, nested_return_type_iterator<T> CI, return_type_iterator<T> I>
+split_batch_result<T> split_batch(CI inputs_begin, CI inputs_end, I separator_begin, I separator_end);
+
+// Helpers
+
+/**
+ * @brief Splits a container of strings based on a specified string separator in one go.
+ * @tparam S String like type
+ * @tparam C Container type holding the strings to split
+ * @param inputs The container of strings to split. The tokens are views into its strings, so it needs to outlive the
+ * result
+ * @param separator The separator to split the strings by
+ * @return The flattened tokens of all inputs
+ */
+template <string_like S, contains_return_type_iterator<string_like_char_t<S>> C>
+inline split_batch_result<string_like_char_t<S>> split_batch(const C& inputs, const S& separator) {
+	return split_batch<string_like_char_t<S>>(std::ranges::begin(inputs), std::ranges::end(inputs),
+	                                          std::ranges::begin(separator), std::ranges::end(separator));
+}
+
+/**
+ * @brief Splitting a temporary container of strings that own their chars would leave the tokens dangling.
+ * @tparam S String like type
+ * @tparam C Container type holding the strings to split
+ */
+template <string_like S, contains_return_type_iterator<string_like_char_t<S>> C>
+    requires(!std::is_lvalue_reference_v<C> && !std::ranges::view<C> &&
+             !std::ranges::borrowed_range<std::ranges::range_value_t<C>>)
+split_batch_result<string_like_char_t<S>> split_batch(C&& inputs, const S& separator) = delete;
+
+// #### rsplit by string ####
+// Actual function
+
+/**
+ * @brief Splits an iterator based string into multiple substrings based on a specified iterator based string separator,
+ * starting from the end of the string.
+ * @tparam T Char type of the string
+ * @tparam C Container type to store the resulting substrings
+ * @tparam I1 Iterator type representing the string
+ * @tparam I2 Iterator type representing the separator
+ * @param str_begin Iterator pointing to the start of the string
+ * @param str_end Iterator pointing to the end of the string
+ * @param separator_begin Iterator pointing to the start of the separator
+ * @param separator_end Iterator pointing to the end of the separator
+ * @param max_splits Maximum number of splits to do. The first substring contains the unsplit rest of the string
+ * @return A container of substrings, in the same order as they appear in the string
+ */
+template <typename T, typename C = std::vector<std::basic_string<T>>, return_type_iterator<T> I1,
+          return_type_iterator<T> I2>
+C rsplit(I1 str_begin, I1 str_end, I2 separator_begin, I2 separator_end, std::size_t max_splits = no_split_limit);
+
+// Helpers
+
+/**
+ * @brief Splits a string into multiple substrings based on a specified string separator, starting from the end of the
+ * string.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @tparam C Container type to store the resulting substrings
+ * @param str The string to split
+ * @param separator The separator to split the string by
+ * @param max_splits Maximum number of splits to do. The first substring contains the unsplit rest of the string
+ * @return A container of substrings, in the same order as they appear in the string
+ */
+template <string_like S1, string_like S2, typename C = std::vector<std::basic_string<string_like_char_t<S1>>>>
+    requires same_char_type<S1, S2>
+inline C rsplit(const S1& str, const S2& separator, std::size_t max_splits = no_split_limit) {
+	return rsplit<string_like_char_t<S1>, C>(std::ranges::begin(str), std::ranges::end(str),
+	                                         std::ranges::begin(separator), std::ranges::end(separator), max_splits);
+}
+
+// #### rsplit by regex ####
+// Actual function
+
+/**
+ * @brief Splits an iterator based string into multiple substrings based on a specified regex separator, only using the
+ * last `max_splits` matches.
+ * @tparam T Char type of the string
+ * @tparam C Container type to store the resulting substrings
+ * @tparam I Iterator type representing the string
+ * @param begin Iterator pointing to the start of the string
+ * @param end Iterator pointing to the end of the string
+ * @param separator Regex based seperator
+ * @param max_splits Maximum number of splits to do. The first substring contains the unsplit rest of the string
+ * @return A container of substrings, in the same order as they appear in the string
+ *
+ * Regexes can't be matched backwards, so unlike the string version this still has to find every match.
+ */
+template <typename T, typename C = std::vector<std::basic_string<T>>, return_type_iterator<T> I>
+C rsplit(I begin, I end, const std::basic_regex<T>& separator, std::size_t max_splits = no_split_limit);
+
+// Helpers
+
+/**
+ * @brief Splits a string into multiple substrings based on a specified regex separator, only using the last
+ * `max_splits` matches.
+ * @tparam S String like type
+ * @tparam C Container type to store the resulting substrings
+ * @param str The string to split
+ * @param separator The separator to split the string by
+ * @param max_splits Maximum number of splits to do. The first substring contains the unsplit rest of the string
+ * @return A container of substrings, in the same order as they appear in the string
+ */
+template <string_like S, typename C = std::vector<std::basic_string<string_like_char_t<S>>>>
+inline C rsplit(const S& str, const std::basic_regex<string_like_char_t<S>>& separator,
+                std::size_t max_splits = no_split_limit) {
+	return rsplit<string_like_char_t<S>, C>(std::ranges::begin(str), std::ranges::end(str), separator, max_splits);
+}
+
+// #### nth field by string ####
+// Actual functions
+
+/**
+ * @brief Gets a single substring `split` would return, without splitting the rest of the string.
+ * @tparam T Char type of the string
+ * @tparam I1 Iterator type representing the string
+ * @tparam I2 Iterator type representing the separator
+ * @param str_begin Iterator pointing to the start of the string
+ * @param str_end Iterator pointing to the end of the string
+ * @param separator_begin Iterator pointing to the start of the separator
+ * @param separator_end Iterator pointing to the end of the separator
+ * @param n Index of the substring, starting at 0
+ * @return A view of the substring, or nothing if there are not enough substrings
+ */
+template <typename T, return_type_iterator<T> I1, return_type_iterator<T> I2>
+std::optional<std::basic_string_view<T>> nth_field(I1 str_begin, I1 str_end, I2 separator_begin, I2 separator_end,
+                                                   std::size_t n);
+
+/**
+ * @brief Gets a single substring `rsplit` would return, counting from the end and without splitting the rest of the
+ * string.
+ * @tparam T Char type of the string
+ * @tparam I1 Iterator type representing the string
+ * @tparam I2 Iterator type representing the separator
+ * @param str_begin Iterator pointing to the start of the string
+ * @param str_end Iterator pointing to the end of the string
+ * @param separator_begin Iterator pointing to the start of the separator
+ * @param separator_end Iterator pointing to the end of the separator
+ * @param n Index of the substring, starting at 0 for the last one
+ * @return A view of the substring, or nothing if there are not enough substrings
+ */
+template <typename T, return_type_iterator<T> I1, return_type_iterator<T> I2>
+std::optional<std::basic_string_view<T>> rnth_field(I1 str_begin, I1 str_end, I2 separator_begin, I2 separator_end,
+                                                    std::size_t n);
+
+// Helpers
+
+/**
+ * @brief Gets a single substring `split` would return, without splitting the rest of the string.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @param str The string to split. The result is a view into it, so it needs to outlive the result
+ * @param separator The separator to split the string by
+ * @param n Index of the substring, starting at 0
+ * @return A view of the substring, or nothing if there are not enough substrings
+ */
+template <string_like S1, string_like S2>
+    requires same_char_type<S1, S2>
+inline std::optional<std::basic_string_view<string_like_char_t<S1>>> nth_field(const S1& str, const S2& separator,
+                                                                               std::size_t n) {
+	return nth_field<string_like_char_t<S1>>(std::ranges::begin(str), std::ranges::end(str),
+	                                         std::ranges::begin(separator), std::ranges::end(separator), n);
+}
+
+/**
+ * @brief Gets a single substring `rsplit` would return, counting from the end and without splitting the rest of the
+ * string.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @param str The string to split. The result is a view into it, so it needs to outlive the result
+ * @param separator The separator to split the string by
+ * @param n Index of the substring, starting at 0 for the last one
+ * @return A view of the substring, or nothing if there are not enough substrings
+ */
+template <string_like S1, string_like S2>
+    requires same_char_type<S1, S2>
+inline std::optional<std::basic_string_view<string_like_char_t<S1>>> rnth_field(const S1& str, const S2& separator,
+                                                                                std::size_t n) {
+	return rnth_field<string_like_char_t<S1>>(std::ranges::begin(str), std::ranges::end(str),
+	                                          std::ranges::begin(separator), std::ranges::end(separator), n);
+}
+
+/**
+ * @brief Getting a substring of a temporary string would leave the view dangling.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ */
+template <string_like S1, string_like S2>
+    requires same_char_type<S1, S2> && (!std::is_lvalue_reference_v<S1> && !std::ranges::borrowed_range<S1>)
+std::optional<std::basic_string_view<string_like_char_t<S1>>> nth_field(S1&& str, const S2& separator,
+                                                                        std::size_t n) = delete;
+
+/**
+ * @brief Getting a substring of a temporary string would leave the view dangling.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ */
+template <string_like S1, string_like S2>
+    requires same_char_type<S1, S2> && (!std::is_lvalue_reference_v<S1> && !std::ranges::borrowed_range<S1>)
+std::optional<std::basic_string_view<string_like_char_t<S1>>> rnth_field(S1&& str, const S2& separator,
+                                                                         std::size_t n) = delete;
+
+// #### nth field by regex ####
+// Actual function
+
+/**
+ * @brief Gets a single substring `split` would return, without splitting the rest of the string.
+ * @tparam T Char type of the string
+ * @tparam I Iterator type representing the string
+ * @param begin Iterator pointing to the start of the string
+ * @param end Iterator pointing to the end of the string
+ * @param separator Regex based seperator
+ * @param n Index of the substring, starting at 0
+ * @return A view of the substring, or nothing if there are not enough substrings
+ */
+template <typename T, return_type_iterator<T> I>
+std::optional<std::basic_string_view<T>> nth_field(I begin, I end, const std::basic_regex<T>& separator,
+                                                   std::size_t n);
+
+// Helpers
+
+/**
+ * @brief Gets a single substring `split` would return, without splitting the rest of the string.
+ * @tparam S String like type
+ * @param str The string to split. The result is a view into it, so it needs to outlive the result
+ * @param separator The separator to split the string by
+ * @param n Index of the substring, starting at 0
+ * @return A view of the substring, or nothing if there are not enough substrings
+ */
+template <string_like S>
+inline std::optional<std::basic_string_view<string_like_char_t<S>>> nth_field(
+    const S& str, const std::basic_regex<string_like_char_t<S>>& separator, std::size_t n) {
+	return nth_field<string_like_char_t<S>>(std::ranges::begin(str), std::ranges::end(str), separator, n);
+}
+
+/**
+ * @brief Getting a substring of a temporary string would leave the view dangling.
+ * @tparam S String like type
+ */
+template <string_like S>
+    requires(!std::is_lvalue_reference_v<S> && !std::ranges::borrowed_range<S>)
+std::optional<std::basic_string_view<string_like_char_t<S>>> nth_field(
+    S&& str, const std::basic_regex<string_like_char_t<S>>& separator, std::size_t n) = delete;
+
+// #### split delimited ####
+// Dialect and field types
+
+/**
+ * @brief Describes the format of delimited records, like CSV or TSV.
+ * @tparam T Char type of the string
+ *
+ * The defaults describe CSV as specified by RFC 4180. Records may end in `\r\n` as well as just `\n`.
+ */
+template <typename T>
+struct delimited_dialect {
+	/// Separates the fields of a record
+	T delimiter = T{','};
+	/// Starts and ends a quoted field, in which delimiters and record separators are part of the field. None disables
+	/// quoting
+	std::optional<T> quote = T{'"'};
+	/// Makes the following char part of the field, whatever it is. None disables escaping
+	std::optional<T> escape = std::nullopt;
+	/// Whether two quotes in a quoted field stand for a single quote
+	bool double_quote = true;
+	/// Separates the records
+	T record_separator = T{'\n'};
+	/// Whether a `\r` directly before an unquoted record separator belongs to the separator, like in CRLF line endings
+	bool crlf = true;
+};
+
+/**
+ * @brief A single field of a delimited record.
+ * @tparam T Char type of the string
+ *
+ * Fields that can be taken from the input as they are, are views into the input. Only fields that need unescaping own
+ * their string.
+ */
+template <typename T>
+struct delimited_field {
+	/// Either a view into the input or the unescaped field
+	std::variant<std::basic_string_view<T>, std::basic_string<T>> value;
+
+	/**
+	 * @brief Access the field, no matter where it is stored.
+	 * @return A view of the field
+	 */
+	std::basic_string_view<T> view() const noexcept {
+		if (const auto* str = std::get_if<std::basic_string<T>>(&value)) {
+			return *str;
+		}
+
+		return std::get<std::basic_string_view<T>>(value);
+	}
+
+	/**
+	 * @brief Whether the field had to be unescaped and owns its string.
+	 * @return True if the field owns its string
+	 */
+	bool owns_string() const noexcept {
+		return std::holds_alternative<std::basic_string<T>>(value);
+	}
+
+	/**
+	 * @brief Compares the field with a string.
+	 * @param other The string to compare to
+	 * @return True if they are equal
+	 */
+	bool operator==(std::basic_string_view<T> other) const noexcept {
+		return view() == other;
+	}
+};
+
+/**
+ * @brief Flattened result of splitting delimited records. Row `i` holds the fields of record `i`.
+ * @tparam T Char type of the string
+ *
+ * Fields that are views point into the original string, so it needs to outlive the result.
+ */
+template <typename T>
+using split_delimited_result = flat_table<delimited_field<T>>;
+
+// Actual function
+
+/**
+ * @brief Splits an iterator based string into records and fields according to the specified dialect.
+ * @tparam T Char type of the string
+ * @tparam I Iterator type representing the string
+ * @param begin Iterator pointing to the start of the string
+ * @param end Iterator pointing to the end of the string
+ * @param dialect Format of the records
+ * @return The flattened fields of all records
+ *
+ * Unless an escape char is set, unquoted separators are found 64 chars at a time with bitmasks: The quote state of
+ * every char is the prefix XOR of the quote mask, so separators inside quotes can simply be masked out. For single
+ * byte chars the masks are built 8 chars at a time with plain integer math, wider chars are compared one by one. A
+ * trailing record separator doesn't start a new record.
+ */
+template <typename T, return_type_iterator<T> I>
+split_delimited_result<T> split_delimited(I begin, I end, const delimited_dialect<T>& dialect = {});
+
+// Helpers
+
+/**
+ * @brief Splits a string into records and fields according to the specified dialect.
+ * @tparam S String like type
+ * @param str The string to split. Fields that are views point into it, so it needs to outlive the result
+ * @param dialect Format of the records
+ * @return The flattened fields of all records
+ */
+template <string_like S>
+inline split_delimited_result<string_like_char_t<S>> split_delimited(
+    const S& str, const delimited_dialect<string_like_char_t<S>>& dialect = {}) {
+	return split_delimited<string_like_char_t<S>>(std::ranges::begin(str), std::ranges::end(str), dialect);
+}
+
+/**
+ * @brief Splitting a temporary string would leave the fields that are views dangling.
+ * @tparam S String like type
+ */
+template <string_like S>
+    requires(!std::is_lvalue_reference_v<S> && !std::ranges::borrowed_range<S>)
+split_delimited_result<string_like_char_t<S>> split_delimited(
+    S&& str, const delimited_dialect<string_like_char_t<S>>& dialect = {}) = delete;
+
+// #### char set ####
+
+/**
+ * @brief A set of chars, each of which acts as a separator on its own.
+ * @tparam T Char type of the string
+ *
+ * Chars below 256 are looked up in a table, so checking them is cheap no matter how many chars are in the set.
+ */
+template <typename T>
+class char_set {
+public:
+	/**
+	 * @brief Creates a set from all chars in a string.
+	 * @tparam S String like type
+	 * @param chars The chars in the set
+	 */
+	template <string_like S>
+	    requires std::is_same_v<string_like_char_t<S>, T>
+	explicit char_set(const S& chars) {
+		for (const T c : chars) {
+			if (to_unsigned(c) < table_size) {
+				table[to_unsigned(c)] = true;
+			} else {
+				wide_chars.push_back(c);
+			}
+		}
+	}
+
+	/**
+	 * @brief Checks if a char is in the set.
+	 * @param c The char to check
+	 * @return True if the char is in the set
+	 */
+	bool contains(T c) const noexcept {
+		if (to_unsigned(c) < table_size) {
+			return table[to_unsigned(c)];
+		}
+
+		return wide_chars.find(c) != std::basic_string<T>::npos;
+	}
+
+private:
+	static constexpr std::size_t table_size = 256;
+
+	std::bitset<table_size> table;
+	std::basic_string<T> wide_chars;
+
+	static constexpr std::size_t to_unsigned(T c) noexcept {
+		return static_cast<std::make_unsigned_t<T>>(c);
+	}
+};
+
+template <string_like S>
+char_set(const S&) -> char_set<string_like_char_t<S>>;
+
+// #### split aligned ####
+// Actual functions
+
+/**
+ * @brief Splits an iterator based string into a specified number of views of about equal length, that only end after
+ * an iterator based string separator.
+ * @tparam T Char type of the string
+ * @tparam C Container type to store the resulting views
+ * @tparam I1 Iterator type representing the string
+ * @tparam I2 Iterator type representing the separator
+ * @param str_begin Iterator pointing to the start of the string
+ * @param str_end Iterator pointing to the end of the string
+ * @param divisions Number of times the string should be divided
+ * @param separator_begin Iterator pointing to the start of the separator
+ * @param separator_end Iterator pointing to the end of the separator
+ * @return A container of views
+ *
+ * Each view ends where the same view of `split(begin, end, divisions)` would, moved forward to the end of the next
+ * separator. So only the distance to the next separator is searched for every view, not the whole string. The
+ * separator stays part of the view before it, and views after the last separator are empty.
+ */
+template <typename T, typename C = std::vector<std::basic_string_view<T>>, return_type_iterator<T> I1,
+          return_type_iterator<T> I2>
+C split_aligned(I1 str_begin, I1 str_end, std::size_t divisions, I2 separator_begin, I2 separator_end);
+
+/**
+ * @brief Splits an iterator based string into a specified number of views of about equal length, that only end after
+ * one of the chars in a set.
+ * @tparam T Char type of the string
+ * @tparam C Container type to store the resulting views
+ * @tparam I Iterator type representing the string
+ * @param begin Iterator pointing to the start of the string
+ * @param end Iterator pointing to the end of the string
+ * @param divisions Number of times the string should be divided
+ * @param separators Chars that can end a view
+ * @return A container of views
+ */
+template <typename T, typename C = std::vector<std::basic_string_view<T>>, return_type_iterator<T> I>
+C split_aligned(I begin, I end, std::size_t divisions, const char_set<T>& separators);
+
+// Helpers
+
+/**
+ * @brief Splits a string into a specified number of views of about equal length, that only end after a string
+ * separator.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @tparam C Container type to store the resulting views
+ * @param str The string to split. The views point into it, so it needs to outlive the result
+ * @param divisions Number of times the string should be divided
+ * @param separator The separator to split the string after
+ * @return A container of views
+ */
+template <string_like S1, string_like S2, typename C = std::vector<std::basic_string_view<string_like_char_t<S1>>>>
+    requires same_char_type<S1, S2>
+inline C split_aligned(const S1& str, std::size_t divisions, const S2& separator) {
+	return split_aligned<string_like_char_t<S1>, C>(std::ranges::begin(str), std::ranges::end(str), divisions,
+	                                                std::ranges::begin(separator), std::ranges::end(separator));
+}
+
+/**
+ * @brief Splits a string into a specified number of views of about equal length, that only end after one of the chars
+ * in a set.
+ * @tparam S String like type
+ * @tparam C Container type to store the resulting views
+ * @param str The string to split. The views point into it, so it needs to outlive the result
+ * @param divisions Number of times the string should be divided
+ * @param separators Chars that can end a view
+ * @return A container of views
+ */
+template <string_like S, typename C = std::vector<std::basic_string_view<string_like_char_t<S>>>>
+inline C split_aligned(const S& str, std::size_t divisions, const char_set<string_like_char_t<S>>& separators) {
+	return split_aligned<string_like_char_t<S>, C>(std::ranges::begin(str), std::ranges::end(str), divisions,
+	                                               separators);
+}
+
+/**
+ * @brief Splitting a temporary string would leave the views dangling.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @tparam C Container type to store the resulting views
+ */
+template <string_like S1, string_like S2, typename C = std::vector<std::basic_string_view<string_like_char_t<S1>>>>
+    requires same_char_type<S1, S2> && (!std::is_lvalue_reference_v<S1> && !std::ranges::borrowed_range<S1>)
+C split_aligned(S1&& str, std::size_t divisions, const S2& separator) = delete;
+
+/**
+ * @brief Splitting a temporary string would leave the views dangling.
+ * @tparam S String like type
+ * @tparam C Container type to store the resulting views
+ */
+template <string_like S, typename C = std::vector<std::basic_string_view<string_like_char_t<S>>>>
+    requires(!std::is_lvalue_reference_v<S> && !std::ranges::borrowed_range<S>)
+C split_aligned(S&& str, std::size_t divisions, const char_set<string_like_char_t<S>>& separators) = delete;
+
+// #### replace all ####
+// Actual functions
+
+/**
+ * @brief Replaces every occurrence of an iterator based string in an iterator based string.
+ * @tparam T Char type of the string
+ * @tparam I1 Iterator type representing the string
+ * @tparam I2 Iterator type representing the string to replace
+ * @tparam I3 Iterator type representing the replacement
+ * @param str_begin Iterator pointing to the start of the string
+ * @param str_end Iterator pointing to the end of the string
+ * @param from_begin Iterator pointing to the start of the string to replace
+ * @param from_end Iterator pointing to the end of the string to replace
+ * @param to_begin Iterator pointing to the start of the replacement
+ * @param to_end Iterator pointing to the end of the replacement
+ * @return The string with all occurrences replaced
+ *
+ * The result is the same as `join(split(str, from), to)`, but the occurrences are counted first, so the result is
+ * allocated exactly once and no substrings get copied in between.
+ */
+template <typename T, return_type_iterator<T> I1, return_type_iterator<T> I2, return_type_iterator<T> I3>
+std::basic_string<T> replace_all(I1 str_begin, I1 str_end, I2 from_begin, I2 from_end, I3 to_begin, I3 to_end);
+
+/**
+ * @brief Replaces every char of an iterator based string that is in a set.
+ * @tparam T Char type of the string
+ * @tparam I1 Iterator type representing the string
+ * @tparam I2 Iterator type representing the replacement
+ * @param str_begin Iterator pointing to the start of the string
+ * @param str_end Iterator pointing to the end of the string
+ * @param from The chars to replace
+ * @param to_begin Iterator pointing to the start of the replacement
+ * @param to_end Iterator pointing to the end of the replacement
+ * @return The string with all chars in the set replaced
+ */
+template <typename T, return_type_iterator<T> I1, return_type_iterator<T> I2>
+std::basic_string<T> replace_all(I1 str_begin, I1 str_end, const char_set<T>& from, I2 to_begin, I2 to_end);
+
+/**
+ * @brief Replaces every match of a regex in an iterator based string.
+ * @tparam T Char type of the string
+ * @tparam I1 Iterator type representing the string
+ * @tparam I2 Iterator type representing the replacement
+ * @param str_begin Iterator pointing to the start of the string
+ * @param str_end Iterator pointing to the end of the string
+ * @param from The regex to replace
+ * @param to_begin Iterator pointing to the start of the replacement
+ * @param to_end Iterator pointing to the end of the replacement
+ * @return The string with all matches replaced
+ *
+ * The replacement is inserted as is, like `std::regex_replace` with `std::regex_constants::format_literal`. The matches
+ * are collected first, so the regex only runs once and the result is still allocated exactly once.
+ */
+template <typename T, return_type_iterator<T> I1, return_type_iterator<T> I2>
+std::basic_string<T> replace_all(I1 str_begin, I1 str_end, const std::basic_regex<T>& from, I2 to_begin, I2 to_end);
+
+// Helpers
+
+/**
+ * @brief Replaces every occurrence of a string in a string.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @tparam S3 String like type
+ * @param str The string to replace in
+ * @param from The string to replace
+ * @param to The replacement
+ * @return The string with all occurrences replaced
+ */
+template <string_like S1, string_like S2, string_like S3>
+    requires same_char_type<S1, S2, S3>
+inline std::basic_string<string_like_char_t<S1>> replace_all(const S1& str, const S2& from, const S3& to) {
+	return replace_all<string_like_char_t<S1>>(std::ranges::begin(str), std::ranges::end(str), std::ranges::begin(from),
+	                                           std::ranges::end(from), std::ranges::begin(to), std::ranges::end(to));
+}
+
+/**
+ * @brief Replaces every char of a string that is in a set.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @param str The string to replace in
+ * @param from The chars to replace
+ * @param to The replacement
+ * @return The string with all chars in the set replaced
+ */
+template <string_like S1, string_like S2>
+    requires same_char_type<S1, S2>
+inline std::basic_string<string_like_char_t<S1>> replace_all(
+    const S1& str, const char_set<string_like_char_t<S1>>& from, const S2& to) {
+	return replace_all<string_like_char_t<S1>>(std::ranges::begin(str), std::ranges::end(str), from,
+	                                           std::ranges::begin(to), std::ranges::end(to));
+}
+
+/**
+ * @brief Replaces every match of a regex in a string.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @param str The string to replace in
+ * @param from The regex to replace
+ * @param to The replacement
+ * @return The string with all matches replaced
+ */
+template <string_like S1, string_like S2>
+    requires same_char_type<S1, S2>
+inline std::basic_string<string_like_char_t<S1>> replace_all(
+    const S1& str, const std::basic_regex<string_like_char_t<S1>>& from, const S2& to) {
+	return replace_all<string_like_char_t<S1>>(std::ranges::begin(str), std::ranges::end(str), from,
+	                                           std::ranges::begin(to), std::ranges::end(to));
+}
+
+// #### translate ####
+// Actual function
+
+/**
+ * @brief Replaces every char of an iterator based string that is in `from` with the char at the same position in `to`.
+ * @tparam T Char type of the string
+ * @tparam I1 Iterator type representing the string
+ * @tparam I2 Iterator type representing the chars to replace
+ * @tparam I3 Iterator type representing the replacement chars
+ * @param str_begin Iterator pointing to the start of the string
+ * @param str_end Iterator pointing to the end of the string
+ * @param from_begin Iterator pointing to the start of the chars to replace
+ * @param from_end Iterator pointing to the end of the chars to replace
+ * @param to_begin Iterator pointing to the start of the replacement chars
+ * @param to_end Iterator pointing to the end of the replacement chars
+ * @return The translated string
+ *
+ * Chars in `from` past the length of `to` are left as they are. If a char is in `from` multiple times, the first one
+ * counts.
+ */
+template <typename T, return_type_iterator<T> I1, return_type_iterator<T> I2, return_type_iterator<T> I3>
+std::basic_string<T> translate(I1 str_begin, I1 str_end, I2 from_begin, I2 from_end, I3 to_begin, I3 to_end);
+
+// Helpers
+
+/**
+ * @brief Replaces every char of a string that is in `from` with the char at the same position in `to`.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @tparam S3 String like type
+ * @param str The string to translate
+ * @param from The chars to replace
+ * @param to The replacement chars
+ * @return The translated string
+ */
+template <string_like S1, string_like S2, string_like S3>
+    requires same_char_type<S1, S2, S3>
+inline std::basic_string<string_like_char_t<S1>> translate(const S1& str, const S2& from, const S3& to) {
+	return translate<string_like_char_t<S1>>(std::ranges::begin(str), std::ranges::end(str), std::ranges::begin(from),
+	                                         std::ranges::end(from), std::ranges::begin(to), std::ranges::end(to));
+}
+
+// #### measure split ####
+// Actual functions
+
+/**
+ * @brief Measures the substrings `split` by string would return, without copying them.
+ * @tparam T Char type of the string
+ * @tparam I1 Iterator type representing the string
+ * @tparam I2 Iterator type representing the separator
+ * @param str_begin Iterator pointing to the start of the string
+ * @param str_end Iterator pointing to the end of the string
+ * @param separator_begin Iterator pointing to the start of the separator
+ * @param separator_end Iterator pointing to the end of the separator
+ * @param max_splits Maximum number of splits to do
+ * @return The number of substrings and their total length
+ */
+template <typename T, return_type_iterator<T> I1, return_type_iterator<T> I2>
+split_measure measure_split(I1 str_begin, I1 str_end, I2 separator_begin, I2 separator_end,
+                            std::size_t max_splits = no_split_limit);
+
+/**
+ * @brief Measures the substrings `split` by regex would return, without copying them.
+ * @tparam T Char type of the string
+ * @tparam I Iterator type representing the string
+ * @param begin Iterator pointing to the start of the string
+ * @param end Iterator pointing to the end of the string
+ * @param separator Regex based seperator
+ * @param max_splits Maximum number of splits to do
+ * @return The number of substrings and their total length
+ */
+template <typename T, return_type_iterator<T> I>
+split_measure measure_split(I begin, I end, const std::basic_regex<T>& separator,
+                            std::size_t max_splits = no_split_limit);
+
+// Helpers
+
+/**
+ * @brief Measures the substrings `split` by string would return, without copying them.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @param str The string to split
+ * @param separator The separator to split the string by
+ * @param max_splits Maximum number of splits to do
+ * @return The number of substrings and their total length
+ */
+template <string_like S1, string_like S2>
+    requires same_char_type<S1, S2>
+inline split_measure measure_split(const S1& str, const S2& separator, std::size_t max_splits = no_split_limit) {
+	return measure_split<string_like_char_t<S1>>(std::ranges::begin(str), std::ranges::end(str),
+	                                             std::ranges::begin(separator), std::ranges::end(separator),
+	                                             max_splits);
+}
+
+/**
+ * @brief Measures the substrings `split` by regex would return, without copying them.
+ * @tparam S String like type
+ * @param str The string to split
+ * @param separator The separator to split the string by
+ * @param max_splits Maximum number of splits to do
+ * @return The number of substrings and their total length
+ */
+template <string_like S>
+inline split_measure measure_split(const S& str, const std::basic_regex<string_like_char_t<S>>& separator,
+                                   std::size_t max_splits = no_split_limit) {
+	return measure_split<string_like_char_t<S>>(std::ranges::begin(str), std::ranges::end(str), separator, max_splits);
+}
+
+/**
+ * @brief Counts the substrings `split` by string would return, without copying them.
+ * @tparam S1 String like type
+ * @tparam S2 String like type
+ * @param str The string to split
+ * @param separator The separator to split the string by
+ * @param max_splits Maximum number of splits to do
+ * @return The number of substrings
+ */
+template <string_like S1, string_like S2>
+    requires same_char_type<S1, S2>
+inline std::size_t count_splits(const S1& str, const S2& separator, std::size_t max_splits = no_split_limit) {
+	return measure_split(str, separator, max_splits).count;
+}
+
+/**
+ * @brief Counts the substrings `split` by regex would return, without copying them.
+ * @tparam S String like type
+ * @param str The string to split
+ * @param separator The separator to split the string by
+ * @param max_splits Maximum number of splits to do
+ * @return The number of substrings
+ */
+template <string_like S>
+inline std::size_t count_splits(const S& str, const std::basic_regex<string_like_char_t<S>>& separator,
+                                std::size_t max_splits = no_split_limit) {
+	return measure_split(str, separator, max_splits).count;
 }
 
 }  // namespace stomfoolery
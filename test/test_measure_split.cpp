@@ -0,0 +1,57 @@
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "stomfoolery.hpp"
+
+using namespace std::string_literals;
+
+const std::vector<std::string> simple_strs{{"a"s}, {"bb"s}, {""s}, {"d"s}, {"e"s}};
+const std::string simple_str_empty_separator{"abcde"s};
+const std::string simple_str_underscore{"a_bb__d_e"s};
+const std::string simple_str_whitespaces{"a b  c\td\n  \t\n\re"s};
+
+const std::string empty_str{""s};
+const std::string underscore{"_"s};
+const std::regex whitespaces{R"(\s+)"};
+
+// Normal cases
+TEST(TestMeasureSplit, SimpleStringsUnderscore) {
+	EXPECT_EQ(stomfoolery::measure_split(simple_str_underscore, underscore), (stomfoolery::split_measure{5, 5}));
+	EXPECT_EQ(stomfoolery::count_splits(simple_str_underscore, underscore), simple_strs.size());
+}
+
+TEST(TestMeasureSplit, SimpleStringsUnderscoreMaxSplits) {
+	EXPECT_EQ(stomfoolery::measure_split(simple_str_underscore, underscore, 2), (stomfoolery::split_measure{3, 7}));
+}
+
+TEST(TestMeasureSplit, SimpleStringsEmptySeparator) {
+	EXPECT_EQ(stomfoolery::measure_split(simple_str_empty_separator, empty_str), (stomfoolery::split_measure{5, 5}));
+}
+
+TEST(TestMeasureSplit, SimpleStringsWhitespaces) {
+	EXPECT_EQ(stomfoolery::measure_split(simple_str_whitespaces, whitespaces), (stomfoolery::split_measure{5, 5}));
+	EXPECT_EQ(stomfoolery::count_splits(simple_str_whitespaces, whitespaces, 1), 2);
+}
+
+TEST(TestMeasureSplit, ExactPolicy) {
+	const auto result = stomfoolery::split(simple_str_underscore, underscore, stomfoolery::split_policy::exact);
+
+	EXPECT_EQ(result, simple_strs);
+	EXPECT_EQ(result.capacity(), result.size());
+}
+
+TEST(TestMeasureSplit, AllPoliciesMatchSplit) {
+	EXPECT_EQ(stomfoolery::split(simple_str_underscore, underscore, stomfoolery::split_policy::grow), simple_strs);
+	EXPECT_EQ(stomfoolery::split(simple_str_underscore, underscore, stomfoolery::split_policy::automatic), simple_strs);
+	EXPECT_EQ(stomfoolery::split(simple_str_whitespaces, whitespaces, stomfoolery::split_policy::exact, 2),
+	          stomfoolery::split(simple_str_whitespaces, whitespaces, 2));
+}
+
+// Edge cases
+TEST(TestMeasureSplit, EmptyString) {
+	EXPECT_EQ(stomfoolery::measure_split(empty_str, underscore), (stomfoolery::split_measure{0, 0}));
+	EXPECT_EQ(stomfoolery::measure_split(empty_str, whitespaces), (stomfoolery::split_measure{0, 0}));
+}
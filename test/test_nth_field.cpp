@@ -0,0 +1,80 @@
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+
+#include "gtest/gtest.h"
+#include "stomfoolery.hpp"
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+const std::string simple_str_empty_separator{"abcde"s};
+const std::string simple_str_underscore{"a_b__d_e"s};
+const std::string simple_str_whitespaces{"a b  c\td\n  \t\n\re"s};
+
+const std::string empty_str{""s};
+const std::string underscore{"_"s};
+const std::regex whitespaces{R"(\s+)"};
+
+template <typename S, typename Separator>
+concept nth_field_gettable =
+    requires(S&& str, const Separator& separator) { stomfoolery::nth_field(std::forward<S>(str), separator, 0); };
+
+template <typename S>
+concept rnth_field_gettable = requires(S&& str) { stomfoolery::rnth_field(std::forward<S>(str), underscore, 0); };
+
+// Normal cases
+TEST(TestNthField, SimpleStringsUnderscore) {
+	EXPECT_EQ(stomfoolery::nth_field(simple_str_underscore, underscore, 0), "a"sv);
+	EXPECT_EQ(stomfoolery::nth_field(simple_str_underscore, underscore, 2), ""sv);
+	EXPECT_EQ(stomfoolery::nth_field(simple_str_underscore, underscore, 4), "e"sv);
+	EXPECT_EQ(stomfoolery::nth_field(simple_str_underscore, underscore, 5), std::nullopt);
+}
+
+TEST(TestNthField, SimpleStringsUnderscoreFromEnd) {
+	EXPECT_EQ(stomfoolery::rnth_field(simple_str_underscore, underscore, 0), "e"sv);
+	EXPECT_EQ(stomfoolery::rnth_field(simple_str_underscore, underscore, 2), ""sv);
+	EXPECT_EQ(stomfoolery::rnth_field(simple_str_underscore, underscore, 4), "a"sv);
+	EXPECT_EQ(stomfoolery::rnth_field(simple_str_underscore, underscore, 5), std::nullopt);
+}
+
+TEST(TestNthField, SimpleStringsEmptySeparator) {
+	EXPECT_EQ(stomfoolery::nth_field(simple_str_empty_separator, empty_str, 1), "b"sv);
+	EXPECT_EQ(stomfoolery::rnth_field(simple_str_empty_separator, empty_str, 1), "d"sv);
+	EXPECT_EQ(stomfoolery::nth_field(simple_str_empty_separator, empty_str, 5), std::nullopt);
+}
+
+TEST(TestNthField, SimpleStringsWhitespaces) {
+	EXPECT_EQ(stomfoolery::nth_field(simple_str_whitespaces, whitespaces, 0), "a"sv);
+	EXPECT_EQ(stomfoolery::nth_field(simple_str_whitespaces, whitespaces, 4), "e"sv);
+	EXPECT_EQ(stomfoolery::nth_field(simple_str_whitespaces, whitespaces, 5), std::nullopt);
+}
+
+// Edge cases
+TEST(TestNthField, OnlySeparator) {
+	EXPECT_EQ(stomfoolery::nth_field(underscore, underscore, 1), ""sv);
+	EXPECT_EQ(stomfoolery::rnth_field(underscore, underscore, 1), ""sv);
+}
+
+TEST(TestNthField, OverlappingSeparator) {
+	// Counting from the end matches rsplit, not split
+	EXPECT_EQ(stomfoolery::nth_field("aaa"sv, "aa"sv, 1), "a"sv);
+	EXPECT_EQ(stomfoolery::rnth_field("aaa"sv, "aa"sv, 0), ""sv);
+	EXPECT_EQ(stomfoolery::rnth_field("aaa"sv, "aa"sv, 1), "a"sv);
+}
+
+TEST(TestNthField, TemporaryString) {
+	// The view would point into the destroyed string
+	EXPECT_FALSE((nth_field_gettable<std::string, std::string>));
+	EXPECT_FALSE((nth_field_gettable<std::string, std::regex>));
+	EXPECT_FALSE(rnth_field_gettable<std::string>);
+	EXPECT_TRUE((nth_field_gettable<const std::string&, std::string>));
+	EXPECT_TRUE((nth_field_gettable<std::string_view, std::regex>));
+	EXPECT_TRUE(rnth_field_gettable<std::string_view>);
+}
+
+TEST(TestNthField, EmptyString) {
+	EXPECT_EQ(stomfoolery::nth_field(empty_str, underscore, 0), std::nullopt);
+	EXPECT_EQ(stomfoolery::nth_field(empty_str, whitespaces, 0), std::nullopt);
+}
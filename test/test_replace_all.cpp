@@ -0,0 +1,55 @@
+#include <regex>
+#include <string>
+#include <string_view>
+
+#include "gtest/gtest.h"
+#include "stomfoolery.hpp"
+
+using namespace std::string_literals;
+
+const std::string simple_str_underscore{"a_b__c_"s};
+const std::string simple_str_replaced{"a::b::::c::"s};
+const std::string simple_str_empty_separator{"abc"s};
+const std::string simple_str_whitespaces{"a b  c\td\n"s};
+
+const std::string empty_str{""s};
+const std::string underscore{"_"s};
+const std::string colons{"::"s};
+const std::regex whitespaces{R"(\s+)"};
+
+// Normal cases
+TEST(TestReplaceAll, SimpleStringsUnderscore) {
+	EXPECT_EQ(stomfoolery::replace_all(simple_str_underscore, underscore, colons), simple_str_replaced);
+}
+
+TEST(TestReplaceAll, SimpleStringsUnderscoreMatchesSplitJoin) {
+	EXPECT_EQ(stomfoolery::replace_all(simple_str_underscore, underscore, colons),
+	          stomfoolery::split(simple_str_underscore, underscore) * colons);
+}
+
+TEST(TestReplaceAll, SimpleStringsEmptySeparator) {
+	EXPECT_EQ(stomfoolery::replace_all(simple_str_empty_separator, empty_str, underscore), "a_b_c"s);
+}
+
+TEST(TestReplaceAll, SimpleStringsCharSet) {
+	EXPECT_EQ(stomfoolery::replace_all(simple_str_whitespaces, stomfoolery::char_set{" \t\n"s}, underscore),
+	          "a_b__c_d_"s);
+}
+
+TEST(TestReplaceAll, SimpleStringsWhitespaces) {
+	EXPECT_EQ(stomfoolery::replace_all(simple_str_whitespaces, whitespaces, underscore), "a_b_c_d_"s);
+}
+
+TEST(TestReplaceAll, Translate) {
+	EXPECT_EQ(stomfoolery::translate(simple_str_whitespaces, " \t\nd"s, "_-|"s), "a_b__c-d|"s);
+}
+
+// Edge cases
+TEST(TestReplaceAll, EmptyString) {
+	EXPECT_EQ(stomfoolery::replace_all(empty_str, underscore, colons), empty_str);
+	EXPECT_EQ(stomfoolery::replace_all(empty_str, empty_str, colons), empty_str);
+}
+
+TEST(TestReplaceAll, NoMatch) {
+	EXPECT_EQ(stomfoolery::replace_all(simple_str_empty_separator, underscore, colons), simple_str_empty_separator);
+}
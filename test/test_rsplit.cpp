@@ -0,0 +1,51 @@
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "stomfoolery.hpp"
+
+using namespace std::string_literals;
+
+const std::vector<std::string> simple_strs{{"a"s}, {"b"s}, {"c"s}, {"d"s}, {"e"s}};
+const std::vector<std::string> simple_strs_two_splits{{"a_b_c"s}, {"d"s}, {"e"s}};
+const std::string simple_str_empty_separator{"abcde"s};
+const std::string simple_str_underscore{"a_b_c_d_e"s};
+const std::string simple_str_whitespaces{"a b  c\td\n  \t\n\re"s};
+
+const std::string empty_str{""s};
+const std::string underscore{"_"s};
+const std::regex whitespaces{R"(\s+)"};
+
+// Normal cases
+TEST(TestRsplit, SimpleStringsUnderscore) {
+	EXPECT_EQ(stomfoolery::rsplit(simple_str_underscore, underscore), simple_strs);
+}
+
+TEST(TestRsplit, SimpleStringsUnderscoreMaxSplits) {
+	EXPECT_EQ(stomfoolery::rsplit(simple_str_underscore, underscore, 2), simple_strs_two_splits);
+}
+
+TEST(TestRsplit, SimpleStringsEmptySeparatorMaxSplits) {
+	EXPECT_EQ(stomfoolery::rsplit(simple_str_empty_separator, empty_str, 2),
+	          (std::vector<std::string>{{"abc"s}, {"d"s}, {"e"s}}));
+}
+
+TEST(TestRsplit, SimpleStringsWhitespaces) {
+	EXPECT_EQ(stomfoolery::rsplit(simple_str_whitespaces, whitespaces), simple_strs);
+}
+
+TEST(TestRsplit, SimpleStringsWhitespacesMaxSplits) {
+	EXPECT_EQ(stomfoolery::rsplit(simple_str_whitespaces, whitespaces, 2),
+	          (std::vector<std::string>{{"a b  c"s}, {"d"s}, {"e"s}}));
+}
+
+// Edge cases
+TEST(TestRsplit, OverlappingSeparator) {
+	EXPECT_EQ(stomfoolery::rsplit("aaa"s, "aa"s), (std::vector<std::string>{{"a"s}, {""s}}));
+}
+
+TEST(TestRsplit, EmptyString) {
+	EXPECT_EQ(stomfoolery::rsplit(empty_str, underscore), std::vector<std::string>{});
+}
@@ -0,0 +1,71 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "stomfoolery.hpp"
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+constexpr std::size_t divisions = 3;
+
+const std::string simple_lines{"aa\nbbbb\nc\ndd\neee\n"s};
+const std::vector<std::string_view> simple_lines_split{{"aa\nbbbb\n"sv}, {"c\ndd\n"sv}, {"eee\n"sv}};
+const std::string simple_records{"a;b\r\nc;d\r\ne;f\r\ng"s};
+const std::vector<std::string_view> simple_records_split{{"a;b\r\nc;d\r\n"sv}, {"e;f\r\n"sv}, {"g"sv}};
+const std::string simple_str_even{"aaaaa"s};
+const std::vector<std::string_view> simple_str_split{{"aa"sv}, {"aa"sv}, {"a"sv}};
+const std::vector<std::string_view> no_separator_split{{"aaaaa"sv}, {""sv}, {""sv}};
+
+const std::vector<std::string_view> empty_container{};
+const std::string empty_str{""s};
+const std::string newline{"\n"s};
+const std::string crlf{"\r\n"s};
+
+template <typename S, typename Separator>
+concept aligned_splittable =
+    requires(S&& str, const Separator& separator) { stomfoolery::split_aligned(std::forward<S>(str), 2, separator); };
+
+// Normal cases
+TEST(TestSplitAligned, SimpleLines) {
+	EXPECT_EQ(stomfoolery::split_aligned(simple_lines, divisions, newline), simple_lines_split);
+}
+
+TEST(TestSplitAligned, SimpleLinesCharSet) {
+	EXPECT_EQ(stomfoolery::split_aligned(simple_lines, divisions, stomfoolery::char_set{"\r\n"s}), simple_lines_split);
+}
+
+TEST(TestSplitAligned, SimpleRecords) {
+	EXPECT_EQ(stomfoolery::split_aligned(simple_records, divisions, crlf), simple_records_split);
+}
+
+TEST(TestSplitAligned, EmptySeparator) {
+	EXPECT_EQ(stomfoolery::split_aligned(simple_str_even, divisions, empty_str), simple_str_split);
+}
+
+TEST(TestSplitAligned, TemporaryString) {
+	// The views would point into the destroyed string
+	EXPECT_FALSE((aligned_splittable<std::string, std::string>));
+	EXPECT_FALSE((aligned_splittable<std::string, stomfoolery::char_set<char>>));
+	EXPECT_TRUE((aligned_splittable<const std::string&, std::string>));
+	EXPECT_TRUE((aligned_splittable<std::string_view, stomfoolery::char_set<char>>));
+}
+
+// Edge cases
+TEST(TestSplitAligned, NoSeparator) {
+	EXPECT_EQ(stomfoolery::split_aligned(simple_str_even, divisions, newline), no_separator_split);
+}
+
+TEST(TestSplitAligned, ZeroDivisions) {
+	EXPECT_EQ(stomfoolery::split_aligned(simple_lines, 0, newline), empty_container);
+}
+
+TEST(TestSplitAligned, CoversString) {
+	for (std::size_t i = 1; i <= simple_lines.size() + 1; ++i) {
+		const auto chunks = stomfoolery::split_aligned(simple_lines, i, newline);
+
+		EXPECT_EQ(chunks.size(), i);
+		EXPECT_EQ(stomfoolery::join(chunks, empty_str), simple_lines);
+	}
+}
@@ -0,0 +1,64 @@
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "stomfoolery.hpp"
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+const std::vector<std::string> simple_inputs{{"a_b"s}, {""s}, {"c"s}, {"d__e"s}};
+const std::vector<std::string_view> simple_tokens{{"a"sv}, {"b"sv}, {"c"sv}, {"d"sv}, {""sv}, {"e"sv}};
+const std::vector<std::size_t> simple_offsets{0, 2, 2, 3, 6};
+const std::vector<std::string_view> simple_tokens_empty_separator{{"a"sv}, {"_"sv}, {"b"sv}, {"c"sv},
+                                                                  {"d"sv}, {"_"sv}, {"_"sv}, {"e"sv}};
+
+const std::vector<std::string> empty_container{};
+const std::string empty_str{""s};
+const std::string underscore{"_"s};
+
+template <typename C>
+concept batch_splittable = requires(C&& inputs) { stomfoolery::split_batch(std::forward<C>(inputs), underscore); };
+
+// Normal cases
+TEST(TestSplitBatch, SimpleStringsUnderscore) {
+	const auto result = stomfoolery::split_batch(simple_inputs, underscore);
+
+	EXPECT_EQ(result.elements, simple_tokens);
+	EXPECT_EQ(result.offsets, simple_offsets);
+	EXPECT_EQ(result.size(), simple_inputs.size());
+}
+
+TEST(TestSplitBatch, SimpleStringsEmptySeparator) {
+	EXPECT_EQ(stomfoolery::split_batch(simple_inputs, empty_str).elements, simple_tokens_empty_separator);
+}
+
+TEST(TestSplitBatch, MatchesSplit) {
+	const auto result = stomfoolery::split_batch(simple_inputs, underscore);
+
+	for (std::size_t i = 0; i < simple_inputs.size(); ++i) {
+		const auto tokens = result[i];
+		const std::vector<std::string> expected = stomfoolery::split(simple_inputs[i], underscore);
+
+		EXPECT_EQ(std::vector<std::string>(tokens.begin(), tokens.end()), expected);
+	}
+}
+
+// Edge cases
+TEST(TestSplitBatch, EmptyContainer) {
+	const auto result = stomfoolery::split_batch(empty_container, underscore);
+
+	EXPECT_TRUE(result.elements.empty());
+	EXPECT_EQ(result.size(), 0);
+}
+
+TEST(TestSplitBatch, TemporaryContainer) {
+	// The tokens would point into the destroyed strings
+	EXPECT_FALSE(batch_splittable<std::vector<std::string>>);
+	EXPECT_TRUE(batch_splittable<const std::vector<std::string>&>);
+	EXPECT_TRUE(batch_splittable<std::span<const std::string>>);
+	// The tokens point into the strings the views refer to, not into the container
+	EXPECT_TRUE(batch_splittable<std::vector<std::string_view>>);
+}
@@ -31,4 +31,15 @@ TEST(TestSplitByRegex, SimpleStringsWhitespacesOperator) {
 	EXPECT_EQ(simple_str_underscore / whitespaces, simple_strs);
 }
 
+// Max splits
+TEST(TestSplitByRegex, MaxSplits) {
+	EXPECT_EQ(stomfoolery::split(simple_str_underscore, whitespaces, 2),
+	          (std::vector<std::string>{{"a"s}, {"b"s}, {"c\td\n  \t\n\re"s}}));
+}
+
+TEST(TestSplitByRegex, ZeroMaxSplits) {
+	EXPECT_EQ(stomfoolery::split(simple_str_underscore, whitespaces, 0),
+	          std::vector<std::string>{simple_str_underscore});
+}
+
 // Edge cases
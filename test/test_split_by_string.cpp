@@ -30,4 +30,20 @@ TEST(TestSplitByString, SimpleStringsUnderscoreOperator) {
 	EXPECT_EQ(simple_str_underscore / underscore, simple_strs);
 }
 
+// Max splits
+TEST(TestSplitByString, MaxSplits) {
+	EXPECT_EQ(stomfoolery::split(simple_str_underscore, underscore, 2),
+	          (std::vector<std::string>{{"a"s}, {"b"s}, {"c_d_e"s}}));
+}
+
+TEST(TestSplitByString, MaxSplitsEmptySeparator) {
+	EXPECT_EQ(stomfoolery::split(simple_str_empty_separator, empty_str, 2),
+	          (std::vector<std::string>{{"a"s}, {"b"s}, {"cde"s}}));
+}
+
+TEST(TestSplitByString, ZeroMaxSplits) {
+	EXPECT_EQ(stomfoolery::split(simple_str_underscore, underscore, 0),
+	          std::vector<std::string>{simple_str_underscore});
+}
+
 // Edge cases
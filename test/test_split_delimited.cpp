@@ -0,0 +1,152 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "stomfoolery.hpp"
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+using records = std::vector<std::vector<std::string>>;
+
+template <typename T>
+records to_records(const stomfoolery::split_delimited_result<T>& delimited) {
+	records result;
+
+	for (std::size_t i = 0; i < delimited.size(); ++i) {
+		auto& fields = result.emplace_back();
+
+		for (const auto& field : delimited[i]) {
+			fields.emplace_back(field.view());
+		}
+	}
+
+	return result;
+}
+
+const std::string simple_csv{"a,b,c\nd,e,f\n"s};
+const records simple_records{{"a"s, "b"s, "c"s}, {"d"s, "e"s, "f"s}};
+const std::string quoted_csv{"\"a,b\",\"c\"\"d\",e\n\"f\ng\",,h"s};
+const records quoted_records{{"a,b"s, "c\"d"s, "e"s}, {"f\ng"s, ""s, "h"s}};
+const std::string crlf_csv{"a,\"b\"\r\nc,\"d\r\"\r\n"s};
+const records crlf_records{{"a"s, "b"s}, {"c"s, "d\r"s}};
+const std::string escaped_tsv{"a\\\tb\tc\\\\\n\"d\te\"\tf"s};
+const records escaped_records{{"a\tb"s, "c\\"s}, {"d\te"s, "f"s}};
+
+const std::string empty_str{""s};
+
+template <typename S>
+concept delimited_splittable = requires(S&& str) { stomfoolery::split_delimited(std::forward<S>(str)); };
+
+// Normal cases
+TEST(TestSplitDelimited, SimpleCsv) {
+	EXPECT_EQ(to_records(stomfoolery::split_delimited(simple_csv)), simple_records);
+}
+
+TEST(TestSplitDelimited, QuotedCsv) {
+	EXPECT_EQ(to_records(stomfoolery::split_delimited(quoted_csv)), quoted_records);
+}
+
+TEST(TestSplitDelimited, CrlfCsv) {
+	const auto result = stomfoolery::split_delimited(crlf_csv);
+
+	EXPECT_EQ(to_records(result), crlf_records);
+	// The `\r` doesn't prevent the quoted last field from being a view
+	EXPECT_FALSE(result[0][1].owns_string());
+}
+
+TEST(TestSplitDelimited, CrlfEscapedTsv) {
+	const stomfoolery::delimited_dialect<char> tsv{.delimiter = '\t', .escape = '\\'};
+	const std::string crlf_tsv{"a\tb\r\nc\\\r\n"s};
+
+	EXPECT_EQ(to_records(stomfoolery::split_delimited(crlf_tsv, tsv)), (records{{"a"s, "b"s}, {"c\r"s}}));
+}
+
+TEST(TestSplitDelimited, CrlfDisabled) {
+	const stomfoolery::delimited_dialect<char> lf{.crlf = false};
+
+	EXPECT_EQ(to_records(stomfoolery::split_delimited("a\r\nb"sv, lf)), (records{{"a\r"s}, {"b"s}}));
+}
+
+TEST(TestSplitDelimited, CarriageReturnRecordSeparator) {
+	// A `\r` that separates records isn't the start of a CRLF line ending
+	const stomfoolery::delimited_dialect<char> mac{.record_separator = '\r'};
+
+	EXPECT_EQ(to_records(stomfoolery::split_delimited("a\r\rb"sv, mac)), (records{{"a"s}, {""s}, {"b"s}}));
+}
+
+TEST(TestSplitDelimited, CarriageReturnDelimiter) {
+	// A `\r` that separates fields isn't the start of a CRLF line ending
+	const stomfoolery::delimited_dialect<char> cr{.delimiter = '\r'};
+
+	EXPECT_EQ(to_records(stomfoolery::split_delimited("a\r\nb"sv, cr)), (records{{"a"s, ""s}, {"b"s}}));
+}
+
+TEST(TestSplitDelimited, EscapedTsv) {
+	const stomfoolery::delimited_dialect<char> tsv{.delimiter = '\t', .escape = '\\'};
+
+	EXPECT_EQ(to_records(stomfoolery::split_delimited(escaped_tsv, tsv)), escaped_records);
+}
+
+TEST(TestSplitDelimited, ZeroCopy) {
+	const auto result = stomfoolery::split_delimited(quoted_csv);
+
+	EXPECT_FALSE(result[0][0].owns_string());
+	EXPECT_TRUE(result[0][1].owns_string());
+	EXPECT_FALSE(result[0][2].owns_string());
+}
+
+TEST(TestSplitDelimited, QuotesAcrossBlocks) {
+	// Make sure the quote state is carried over into the next block of 64 chars
+	const std::string long_field = "x"s * 100 + ",\n"s;
+	const std::string csv = "a,\""s + long_field + "\",b"s;
+
+	EXPECT_EQ(to_records(stomfoolery::split_delimited(csv)), (records{{"a"s, long_field, "b"s}}));
+}
+
+TEST(TestSplitDelimited, CrlfAcrossBlocks) {
+	// Make sure a `\r` at the end of a block is dropped together with the `\n` starting the next one
+	const std::string csv = "x"s * 63 + "\r\ny"s;
+
+	EXPECT_EQ(to_records(stomfoolery::split_delimited(csv)), (records{{"x"s * 63}, {"y"s}}));
+}
+
+TEST(TestSplitDelimited, TemporaryString) {
+	// The fields that are views would point into the destroyed string
+	EXPECT_FALSE(delimited_splittable<std::string>);
+	EXPECT_TRUE(delimited_splittable<const std::string&>);
+	EXPECT_TRUE(delimited_splittable<std::string_view>);
+}
+
+TEST(TestSplitDelimited, HighBitChars) {
+	// Chars that only differ from a separator in the high bit must not be taken for it
+	const std::string field = "\xac\x8a\x8d\xa2"s * 20;
+	const std::string csv = field + ","s + field + "\r\n"s + field;
+
+	EXPECT_EQ(to_records(stomfoolery::split_delimited(csv)), (records{{field, field}, {field}}));
+}
+
+TEST(TestSplitDelimited, WideChars) {
+	const std::wstring csv = L"a,\"b,c\"\r\n"s * 10;
+	const auto result = stomfoolery::split_delimited(csv);
+
+	ASSERT_EQ(result.size(), 10);
+	EXPECT_EQ(result[9][1], L"b,c"sv);
+}
+
+// Edge cases
+TEST(TestSplitDelimited, EmptyString) {
+	EXPECT_EQ(to_records(stomfoolery::split_delimited(empty_str)), records{});
+}
+
+TEST(TestSplitDelimited, TrailingDelimiter) {
+	EXPECT_EQ(to_records(stomfoolery::split_delimited("a,"sv)), (records{{"a"s, ""s}}));
+}
+
+TEST(TestSplitDelimited, Offsets) {
+	const auto result = stomfoolery::split_delimited(quoted_csv);
+
+	EXPECT_EQ(result.offsets, (std::vector<std::size_t>{0, 3, 6}));
+	EXPECT_EQ(result.size(), 2);
+}